@@ -0,0 +1,119 @@
+/*
+ *  Cost of a disabled log level function in a tight loop. Built once per
+ *  variant by `make bench`:
+ *
+ *      BENCH_REMOVED       Debug logs compiled out with `CLOG_LEVEL`.
+ *      BENCH_ATOMIC        Debug logs disabled with `CLOG_SET_LEVEL`.
+ *      BENCH_STATIC_KEYS   Debug logs disabled with `CLOG_SET_LEVEL` and
+ *                          `CLOG_USE_STATIC_KEYS`.
+ *      BENCH_CALL_SITES    Debug logs disabled with `CLOG_SET_LEVEL` and
+ *                          `CLOG_USE_CALL_SITES`.
+ *      BENCH_LOGGERS       Debug logs of a named logger disabled with
+ *                          `CLOG_SET_LEVEL` and `CLOG_USE_LOGGERS`.
+ *      BENCH_THREAD_LEVELS Debug logs disabled with `CLOG_SET_LEVEL` and
+ *                          `CLOG_USE_THREAD_LEVELS`.
+ */
+
+#define CLOG_FILE           "bench-level.log"
+
+#if defined(BENCH_REMOVED)
+    #define CLOG_LEVEL      CLOG_LEVEL_INFO
+    #define BENCH_NAME      "compiled out"
+#elif defined(BENCH_STATIC_KEYS)
+    #define CLOG_USE_STATIC_KEYS
+    #define BENCH_NAME      "static keys"
+#elif defined(BENCH_CALL_SITES)
+    #define CLOG_USE_CALL_SITES
+    #define BENCH_NAME      "call sites"
+#elif defined(BENCH_LOGGERS)
+    #define CLOG_USE_LOGGERS
+    #define BENCH_NAME      "loggers"
+#elif defined(BENCH_THREAD_LEVELS)
+    #define CLOG_USE_THREAD_LEVELS
+    #define BENCH_NAME      "thread levels"
+#else
+    #define BENCH_NAME      "atomic check"
+#endif
+
+#include <stdio.h>
+#include <time.h>
+#include "clog.h"
+
+
+#define ITERATIONS          200000000
+#define ROUNDS              5
+
+
+#ifdef BENCH_LOGGERS
+    CLOG_DEFINE_LOGGER(bench_logger, "bench");
+    #define BENCH_LOG(...)  LOGFLN_TO(bench_logger, DEBUG, __VA_ARGS__)
+#else
+    #define BENCH_LOG(...)  LOGFLN_DEBUG(__VA_ARGS__)
+#endif
+
+
+/**
+ * @brief   Get the monotonic time in nanoseconds.
+ *
+ * @return  Nanoseconds.
+ */
+static long long now() {
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+
+/**
+ * @brief   Run a loop with a disabled debug log per iteration.
+ *
+ * @param   seed    Loop input the compiler cannot see.
+ * @return  Loop result.
+ */
+static __attribute__((__noinline__)) unsigned run(unsigned seed) {
+
+    unsigned x = seed;
+
+    for (int i = 0;  i < ITERATIONS;  ++i) {
+        x += (unsigned) i ^ seed;
+        BENCH_LOG("x %u", x);
+    }
+
+    return x;
+}
+
+
+/**
+ * @brief   Main function to run the benchmark.
+ *
+ * @return  Return 0.
+ */
+int main(int argc, char** argv) {
+
+    long long best = -1;
+    long long start;
+    long long elapsed;
+    unsigned x = 0;
+
+    (void) argv;
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    for (int i = 0;  i < ROUNDS;  ++i) {
+        start = now();
+        x += run((unsigned) argc + x);
+        elapsed = now() - start;
+
+        if (best < 0 || elapsed < best)
+            best = elapsed;
+    }
+
+    printf(
+        "%-14s %.3f ns per iteration (%u)\n",
+        BENCH_NAME, (double) best / ITERATIONS, x & 1
+    );
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ *  Cost of writing logs from several threads at once. Built once per variant
+ *  by `make bench`, with and without `CLOG_THREAD_SAFE`:
+ *
+ *      BENCH_CONSOLE       Logs to standard error (run with standard error
+ *                          redirected to /dev/null).
+ *      BENCH_REOPEN        Logs to the log file in reopen file mode.
+ *      BENCH_PERSISTENT    Logs to the log file in persistent file mode.
+ *
+ *  Every thread count writes the same number of logs in total, so the time
+ *  per log shows how well the writes scale across threads. Without
+ *  `CLOG_THREAD_SAFE`, logging from several threads is a data race, so the
+ *  baseline only runs a single thread. The numbers only mean something on a
+ *  machine with at least as many CPUs as threads; with fewer, they mostly
+ *  measure the scheduler.
+ */
+
+#define CLOG_FILE           "bench-threads.log"
+
+#if defined(BENCH_REOPEN)
+    #define CLOG_MODE       CLOG_MODE_FILE
+    #define BENCH_SINK      "file reopen"
+#elif defined(BENCH_PERSISTENT)
+    #define CLOG_MODE       CLOG_MODE_FILE
+    #define CLOG_FILE_MODE  CLOG_FILE_MODE_PERSISTENT
+    #define BENCH_SINK      "file persistent"
+#else
+    #define CLOG_MODE       CLOG_MODE_CONSOLE
+    #define BENCH_SINK      "console"
+#endif
+
+#ifdef BENCH_THREAD_SAFE
+    #define CLOG_THREAD_SAFE
+    #define BENCH_MODE      "thread safe"
+#else
+    #define BENCH_MODE      "default"
+#endif
+
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "clog.h"
+
+
+#define LOGS                200000
+#define ROUNDS              3
+
+
+#ifdef BENCH_THREAD_SAFE
+    static const int threads[] = { 1, 4, 16, 64 };
+#else
+    static const int threads[] = { 1 };
+#endif
+
+
+/**
+ * @brief   Get the monotonic time in nanoseconds.
+ *
+ * @return  Nanoseconds.
+ */
+static long long now() {
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+
+/**
+ * @brief   Write the logs of one thread.
+ *
+ * @param   arg     Number of logs to write.
+ * @return  NULL.
+ */
+static void* run(void* arg) {
+
+    long logs = (long) arg;
+
+    for (long i = 0;  i < logs;  ++i)
+        LOGFLN_INFO("thread log %ld of %ld", i, logs);
+
+    return NULL;
+}
+
+
+/**
+ * @brief   Write `LOGS` logs from the given number of threads.
+ *
+ * @param   count   Number of threads.
+ * @return  Nanoseconds taken.
+ */
+static long long round_run(int count) {
+
+    pthread_t ids[64];
+    long long start;
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+    start = now();
+
+    for (int i = 0;  i < count;  ++i)
+        pthread_create(&ids[i], NULL, run, (void*) (long) (LOGS / count));
+
+    for (int i = 0;  i < count;  ++i)
+        pthread_join(ids[i], NULL);
+
+    FLOG_FLUSH();
+
+    return now() - start;
+}
+
+
+/**
+ * @brief   Main function to run the benchmark.
+ *
+ * @return  Return 0.
+ */
+int main() {
+
+    long long best;
+    long long elapsed;
+
+    printf("%-16s %-12s", BENCH_SINK, BENCH_MODE);
+
+    for (size_t t = 0;  t < sizeof(threads) / sizeof(*threads);  ++t) {
+        best = -1;
+
+        for (int i = 0;  i < ROUNDS;  ++i) {
+            elapsed = round_run(threads[t]);
+
+            if (best < 0 || elapsed < best)
+                best = elapsed;
+        }
+
+        printf("  %2d: %7.1f", threads[t], (double) best / LOGS);
+    }
+
+    printf(
+        "  ns per log by threads (%ld CPUs)\n", sysconf(_SC_NPROCESSORS_ONLN)
+    );
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+
+    return 0;
+}
@@ -91,6 +91,8 @@
  *          manually inserted or using "cclog" functions will remain.
  *
  *      * What file gets written to for file logging.
+ *      * Whether the log file is reopened for every log or kept open.
+ *      * Whether logs are written on the calling thread or by a writer thread.
  *      * Whether "log" logs to console, or a file, or both.
  *
  *  All of these options have defaults that work out of the box with just the
@@ -170,6 +172,26 @@
  *  Defaults to "file.c.log" where the C source file name is "file.c".
  *
  *
+ *  Log File Mode
+ *  -------------
+ *
+ *  By default, the log file is opened and closed for every log. The log file
+ *  mode may be set to persistent to open each log file once and keep a
+ *  buffered handle open until the program exits. The flush policy decides
+ *  when buffered logs are written: after every log (default), after a number
+ *  of logs, or only when the buffer is full and at exit.
+ *
+ *
+ *  Asynchronous Logging
+ *  --------------------
+ *
+ *  By default, logs are written on the calling thread. Asynchronous mode may
+ *  be enabled to copy formatted logs into a bounded ring instead, which a
+ *  writer thread drains to standard error and the log files in batches. The
+ *  ring is drained fully at exit and by `FLOG_FLUSH()`. Asynchronous mode
+ *  needs POSIX threads.
+ *
+ *
  *  Log Time Format
  *  ---------------
  *
@@ -185,6 +207,38 @@
  *  Timestamps are enabled by default but can be disabled by uncommenting the
  *  disable timestamps macro.
  *
+ *  Timestamps are formatted at most once per second per thread. Logs within
+ *  the same second copy the cached timestamp, and the local time zone offset is
+ *  only looked up again every 15 minutes, so a change of the time zone
+ *  (e.g. setting TZ) while running takes effect within 15 minutes.
+ *
+ *  Timestamps have a precision of seconds by default. The time precision can
+ *  be set to milliseconds, microseconds or nanoseconds, which adds the
+ *  fraction of the second after the seconds, e.g. "2025-05-01T12:23:45.123456"
+ *  for microseconds. The default "%FT%T%z" and "%FT%TZ" formats are formatted
+ *  without strftime. With other formats, the fraction is added after the
+ *  first "%S", "%T" or "%s", or left out if the format has no seconds.
+ *
+ *  Timestamps are read from the real time clock by default. The clock can be
+ *  changed with the clock option, or at runtime with `CLOG_SET_CLOCK`:
+ *
+ *      CLOG_CLOCK_REALTIME         The real time clock.
+ *      CLOG_CLOCK_REALTIME_COARSE  The coarse real time clock, which is the
+ *                                  cheapest to read but only advances every
+ *                                  few milliseconds.
+ *      CLOG_CLOCK_MONOTONIC        The monotonic clock counted from the wall
+ *                                  time of the first log, so timestamps never
+ *                                  go back when the system time is changed.
+ *      CLOG_CLOCK_TSC              Like the monotonic clock, but reads the CPU
+ *                                  time stamp counter (x86-64 with an invariant
+ *                                  TSC only). The counter rate is measured
+ *                                  against the monotonic clock while running.
+ *                                  In asynchronous mode, logs only read the
+ *                                  counter and the writer thread converts and
+ *                                  formats their timestamps.
+ *      CLOG_CLOCK_UPTIME           Seconds since the first log instead of a
+ *                                  date and time.
+ *
  *
  *  Tracing Separator
  *  -----------------
@@ -294,7 +348,6 @@
 
 /**
  * Uncomment this to customize the line header separator (defaults to space).
- * Percentage symbols is not currently supported do to format strings.
  */
 
 //#define CLOG_LINE_HEADER_SEP      " "
@@ -302,7 +355,6 @@
 
 /**
  * Uncomment this to customize the tracing separator (defaults to colon).
- * Percentage symbols is not currently supported do to format strings.
  */
 
 //#define CLOG_TRACING_SEP            ":"
@@ -411,6 +463,102 @@
 //#define CLOG_LEVEL                  CLOG_LEVEL_ALL
 
 
+/**
+ * Uncomment these to set the log level of single modules. A C file joins a
+ * module by defining `CLOG_MODULE` to the module name before including
+ * "clog.h", and its `CLOG_LEVEL` is then replaced by the level of its module.
+ * Modules without a level keep `CLOG_LEVEL`.
+ */
+
+//#define CLOG_MODULE_LEVEL_example     CLOG_LEVEL_WARNING
+
+
+/* Logging level mask for what log levels are compiled options */
+
+#define CLOG_MASK_NONE              0           // Disable all log levels.
+#define CLOG_MASK_TRACE             (1 << 0)    // Enable TRACE level logs.
+#define CLOG_MASK_DEBUG             (1 << 1)    // Enable DEBUG level logs.
+#define CLOG_MASK_EXTRA             (1 << 2)    // Enable EXTRA level logs.
+#define CLOG_MASK_INFO              (1 << 3)    // Enable INFO level logs.
+#define CLOG_MASK_HEADER            (1 << 4)    // Enable HEADER level logs.
+#define CLOG_MASK_SUCCESS           (1 << 5)    // Enable SUCCESS level logs.
+#define CLOG_MASK_MONEY             (1 << 6)    // Enable MONEY level logs.
+#define CLOG_MASK_INPUT             (1 << 7)    // Enable INPUT level logs.
+#define CLOG_MASK_WARNING           (1 << 8)    // Enable WARNING level logs.
+#define CLOG_MASK_ERROR             (1 << 9)    // Enable ERROR level logs.
+#define CLOG_MASK_CRITICAL          (1 << 10)   // Enable CRITICAL level logs.
+#define CLOG_MASK_FATAL             (1 << 11)   // Enable FATAL level logs.
+#define CLOG_MASK_ALL               0xfff       // Enable all log levels.
+
+/**
+ * Uncomment this to only compile the log levels in the given mask, a bitwise
+ * OR of the options above such as `(CLOG_MASK_TRACE | CLOG_MASK_ERROR)`.
+ * Applies together with `CLOG_LEVEL`. Defaults to not defined.
+ */
+
+//#define CLOG_LEVEL_MASK             CLOG_MASK_ALL
+
+
+/**
+ * Uncomment this to set the runtime log level at program start from the given
+ * environment variable (a level name such as "debug" or its number, or a
+ * comma separated list of level names such as "trace,error" for a mask).
+ */
+
+//#define CLOG_LEVEL_ENV              "CLOG_LEVEL"
+
+
+/**
+ * Uncomment this to turn the log level functions of disabled levels into
+ * no-ops by rewriting the program code when the runtime log level changes
+ * (x86-64 only).
+ */
+
+//#define CLOG_USE_STATIC_KEYS
+
+
+/**
+ * Uncomment this to record every log level function call site so that single
+ * call sites can be enabled or disabled at runtime with control queries such
+ * as "file main.c func parse_* level debug +p".
+ */
+
+//#define CLOG_USE_CALL_SITES
+
+
+/**
+ * Adjust these to read call site control queries from a file at program start
+ * and whenever the program receives the given signal.
+ */
+
+//#define CLOG_CALL_SITES_FILE        "clog-sites.conf"
+//#define CLOG_CALL_SITES_SIGNAL      SIGUSR1
+
+
+/**
+ * Uncomment this to log to named loggers (such as "net.tls") with the `*_TO`
+ * log functions, with runtime log levels inherited down the logger names.
+ */
+
+//#define CLOG_USE_LOGGERS
+
+
+/**
+ * Uncomment this to raise the runtime log level of single threads with the
+ * `CLOG_SET_THREAD_LEVEL` functions.
+ */
+
+//#define CLOG_USE_THREAD_LEVELS
+
+
+/**
+ * Uncomment this to add the occurrence number (such as "#1001: ") to the line
+ * header of the `_ONCE`, `_FIRST_N` and `_EVERY_N` sampled logs.
+ */
+
+//#define CLOG_SAMPLE_NUMBERS
+
+
 /**
  * Adjust this to define the log filepath. Defaults to source code filename if
  * not defined.
@@ -419,6 +567,172 @@
 //#define CLOG_FILE                   "clog.log"
 
 
+/* Log file handle mode options */
+
+#define CLOG_FILE_MODE_REOPEN       0   // Open and close the log file for
+                                        // every file log (default).
+#define CLOG_FILE_MODE_PERSISTENT   1   // Open the log file once and keep it
+                                        // open until the program exits.
+
+/**
+ * Adjust this to change the log file mode. Defaults to
+ * `CLOG_FILE_MODE_REOPEN`.
+ */
+
+//#define CLOG_FILE_MODE              CLOG_FILE_MODE_REOPEN
+
+
+/* Log file flush policy options (persistent log file mode only) */
+
+#define CLOG_FILE_FLUSH_ALWAYS      0   // Flush after every file log
+                                        // (default).
+#define CLOG_FILE_FLUSH_COUNT       1   // Flush after every
+                                        // `CLOG_FILE_FLUSH_LINES` file logs.
+#define CLOG_FILE_FLUSH_EXIT        2   // Flush when the buffer is full,
+                                        // on `FLOG_FLUSH()`, and at exit.
+
+/**
+ * Adjust this to change the log file flush policy. Defaults to
+ * `CLOG_FILE_FLUSH_ALWAYS`.
+ */
+
+//#define CLOG_FILE_FLUSH             CLOG_FILE_FLUSH_ALWAYS
+
+
+/**
+ * Adjust this to change the number of file logs between flushes for the
+ * `CLOG_FILE_FLUSH_COUNT` flush policy. Defaults to 64.
+ */
+
+//#define CLOG_FILE_FLUSH_LINES       64
+
+
+/**
+ * Adjust this to change the buffer size of persistent log files. Defaults to
+ * 64 KiB.
+ */
+
+//#define CLOG_FILE_BUFSZ             65536
+
+
+/**
+ * Adjust this to change the size of the stack buffer each log is assembled in.
+ * Longer logs are moved to the heap. Defaults to 1024 bytes.
+ */
+
+//#define CLOG_LINE_BUFSZ             1024
+
+
+/**
+ * Adjust this to limit the number of bytes the "hexdump" functions dump.
+ * Defaults to 0 (no limit).
+ */
+
+//#define CLOG_HEXDUMP_MAX            0
+
+
+/**
+ * Uncomment this to write each log to standard error and the log file in one
+ * piece when logging from several threads.
+ */
+
+//#define CLOG_THREAD_SAFE
+
+
+/**
+ * Uncomment this to collect logs in a buffer per thread that is written with
+ * a single write when it is full, on a log at or above the flush level, after
+ * the idle time and at thread and program exit.
+ */
+
+//#define CLOG_USE_BUFFER
+
+
+/**
+ * Adjust these to change the per-thread log buffers. The flush level is one of
+ * the CLOG_LEVEL_* options.
+ */
+
+//#define CLOG_BUFFER_SIZE            32768
+//#define CLOG_BUFFER_FLUSH_LEVEL     CLOG_LEVEL_WARNING
+//#define CLOG_BUFFER_IDLE_MS         1000
+
+
+/**
+ * Uncomment this to write logs asynchronously by a writer thread.
+ */
+
+//#define CLOG_USE_ASYNC
+
+
+/**
+ * Adjust these to change the asynchronous log ring. The number of slots must
+ * be a power of two. Logs longer than the maximum line length (at least 64)
+ * are truncated, keeping their newline.
+ */
+
+//#define CLOG_ASYNC_SLOTS            1024
+//#define CLOG_ASYNC_LINE_MAX         512
+
+
+/**
+ * Adjust this to change the batch buffer size of the writer thread. Defaults
+ * to 64 KiB.
+ */
+
+//#define CLOG_ASYNC_BATCH_SIZE       65536
+
+
+/**
+ * Adjust this to change the longest time in milliseconds logs wait in the
+ * ring. Defaults to 10.
+ */
+
+//#define CLOG_ASYNC_INTERVAL_MS      10
+
+
+/**
+ * Uncomment this to make logs wait for free space when the ring is full
+ * instead of dropping them.
+ */
+
+//#define CLOG_ASYNC_BLOCK
+
+
+/**
+ * Uncomment this to shed the lowest log levels step by step while the
+ * asynchronous log ring fills up, and log them again once it drains.
+ */
+
+//#define CLOG_ASYNC_SHED
+
+
+/**
+ * Adjust these to change the load shedding high-water marks, in percent of
+ * the asynchronous log ring.
+ */
+
+//#define CLOG_ASYNC_SHED_MARK        50
+//#define CLOG_ASYNC_SHED_STEP        10
+//#define CLOG_ASYNC_SHED_HYSTERESIS  20
+
+
+/**
+ * Uncomment this to count repeats of the last log instead of writing them and
+ * write a "last message repeated N times" log when the run ends.
+ */
+
+//#define CLOG_USE_DEDUP
+
+
+/**
+ * Adjust this to change the longest time in milliseconds repeats are counted
+ * before their summary is written. Defaults to 30000.
+ */
+
+//#define CLOG_DEDUP_WINDOW_MS        30000
+
+
 /**
  * Adjust this to define a timestamp format. Defaults to ANZI ISO 8601 time
  * format.
@@ -427,6 +741,24 @@
 //#define CLOG_TIME_FORMAT            "%FT%T%z"
 
 
+/**
+ * Adjust this to change the precision of timestamps to
+ * CLOG_TIME_PRECISION_MSEC, CLOG_TIME_PRECISION_USEC or
+ * CLOG_TIME_PRECISION_NSEC. Defaults to CLOG_TIME_PRECISION_SEC.
+ */
+
+//#define CLOG_TIME_PRECISION         CLOG_TIME_PRECISION_SEC
+
+
+/**
+ * Adjust this to change the clock timestamps are read from to
+ * CLOG_CLOCK_REALTIME_COARSE, CLOG_CLOCK_MONOTONIC, CLOG_CLOCK_TSC or
+ * CLOG_CLOCK_UPTIME. Defaults to CLOG_CLOCK_REALTIME.
+ */
+
+//#define CLOG_CLOCK                  CLOG_CLOCK_REALTIME
+
+
 /**
  * Uncomment this to disable timestamps. Defaults to timestamps enabled.
  */
@@ -0,0 +1,120 @@
+
+#include "test-config-18.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_file_persistent();
+static struct test* test_manual_file_persistent_paths();
+
+
+// Main test function.
+
+struct unit* unit_config_18() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 18 Options");
+
+    ADD_TEST(unit, test_manual_file_persistent());
+    ADD_TEST(unit, test_manual_file_persistent_paths());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_file_persistent() {
+
+    int fd;
+    char buf[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // Open the log file explicitly.
+    unlink(CLOG_FILE);
+    FLOG_OPEN();
+
+    fd = open(CLOG_FILE, O_RDONLY);
+    ASSERT(fd != -1 && "Log file not created by `FLOG_OPEN`.");
+
+    // Logs stay buffered until flushed.
+    FLOGLN("MARKER");
+    bzero(buf, LINE_BUF_SIZE);
+    read(fd, buf, LINE_BUF_SIZE);
+    ASSERT(!*buf && "Log written before flush.");
+
+    FLOG_FLUSH();
+    PRINT_FILE_LINE(fd, buf);
+    ASSERT(strstr(buf, "MARKER\n") && "Log not written on flush.");
+    close(fd);
+
+    // Closed log files are reopened by the next log.
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+    FLOGLN_INFO("REOPEN MARKER");
+    FLOG_FLUSH();
+
+    fd = open(CLOG_FILE, O_RDONLY);
+    ASSERT(fd != -1 && "Log file not reopened after `FLOG_CLOSE`.");
+    PRINT_FILE_LINE(fd, buf);
+    ASSERT(strstr(buf, "REOPEN MARKER\n") && "Log not written after reopen.");
+    close(fd);
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+// Log file path changes at runtime to test handles of different paths.
+#undef CLOG_FILE
+#define CLOG_FILE   _test_log_file
+
+static const char* _test_log_file = "clog-persistent-1.log";
+
+static struct test* test_manual_file_persistent_paths() {
+
+    int fd_1, fd_2;
+    char buf[LINE_BUF_SIZE];
+    char path[] = "clog-persistent-2.log";
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink("clog-persistent-1.log");
+    unlink("clog-persistent-2.log");
+
+    _test_log_file = "clog-persistent-1.log";
+    FLOGLN("MARKER 1");
+
+    // Same path at a different address uses the same handle.
+    _test_log_file = path;
+    FLOGLN("MARKER 2");
+    _test_log_file = "clog-persistent-2.log";
+    FLOGLN("MARKER 3");
+    FLOG_FLUSH();
+
+    fd_1 = open("clog-persistent-1.log", O_RDONLY);
+    ASSERT(fd_1 != -1 && "Failed to open first log file.");
+    PRINT_FILE_LINE(fd_1, buf);
+    ASSERT(strstr(buf, "MARKER 1\n") && "First log file missing log.");
+    ASSERT(!strstr(buf, "MARKER 2") && "First log file has wrong log.");
+    close(fd_1);
+
+    fd_2 = open("clog-persistent-2.log", O_RDONLY);
+    ASSERT(fd_2 != -1 && "Failed to open second log file.");
+    PRINT_FILE_LINE(fd_2, buf);
+    ASSERT(strstr(buf, "MARKER 2\n") && "Second log file missing log.");
+    ASSERT(strstr(buf, "MARKER 3\n") && "Second log file missing log.");
+    close(fd_2);
+    puts("\n");
+
+    PASS_TEST();
+}
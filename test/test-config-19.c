@@ -0,0 +1,238 @@
+
+#include "test-config-19.h"
+
+
+#define THREADS         4
+#define THREAD_LOGS     100
+
+
+// Function Declarations
+
+static struct test* test_manual_async_console();
+static struct test* test_manual_async_file();
+static struct test* test_manual_async_threads();
+static struct test* test_manual_async_long();
+static struct test* test_manual_async_tsc();
+
+
+// Main test function.
+
+struct unit* unit_config_19() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 19 Options");
+
+    ADD_TEST(unit, test_manual_async_console());
+    ADD_TEST(unit, test_manual_async_file());
+    ADD_TEST(unit, test_manual_async_threads());
+    ADD_TEST(unit, test_manual_async_long());
+    ADD_TEST(unit, test_manual_async_tsc());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_async_console() {
+
+    char buf[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // The writer thread writes to the redirected standard error until flushed.
+    FILL_LINE_BUF_FROM_STDERR(buf, LINE_BUF_SIZE, {
+        CLOGLN("MARKER");
+        CCLOGLN(RED, "COLOR MARKER");
+        FLOG_FLUSH();
+    });
+    printf("STDERR: %s", buf);
+    ASSERT(strstr(buf, " MARKER\n") && "Console log not written.");
+    ASSERT(strstr(buf, RED "COLOR MARKER" RESET "\n") && "Color log not written.");
+    ASSERT(strstr(buf, " MARKER\n") < strstr(buf, "COLOR MARKER") && "Logs out of order.");
+    puts("");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_async_file() {
+
+    int fd;
+    char buf[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+    errno = ENOENT;
+    FLOG_PERRORF("MARKER %d", 1);
+    FLOG_FLUSH();
+
+    fd = open(CLOG_FILE, O_RDONLY);
+    ASSERT(fd != -1 && "Log file not written on flush.");
+    PRINT_FILE_LINE(fd, buf);
+    ASSERT(strstr(buf, "MARKER 1: No such file or directory\n") && "Log missing.");
+    close(fd);
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+static void* log_thread(void* arg) {
+
+    for (int i = 0;  i < THREAD_LOGS;  ++i)
+        FLOGFLN("THREAD %ld LOG %d", (long) arg, i);
+
+    return NULL;
+}
+
+static struct test* test_manual_async_threads() {
+
+    pthread_t threads[THREADS];
+    char line[LINE_BUF_SIZE];
+    int last[THREADS];
+    int count = 0;
+    long thread;
+    int log;
+    FILE* fp;
+
+    TEST_HEADER(__FUNCTION__);
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+
+    for (long i = 0;  i < THREADS;  ++i)
+        pthread_create(&threads[i], NULL, log_thread, (void*) i);
+
+    for (int i = 0;  i < THREADS;  ++i) {
+        pthread_join(threads[i], NULL);
+        last[i] = -1;
+    }
+
+    FLOG_FLUSH();
+
+    // Every log is whole and logs of each thread are in order.
+    fp = fopen(CLOG_FILE, "r");
+    ASSERT(fp && "Log file not written on flush.");
+
+    while (fgets(line, LINE_BUF_SIZE, fp)) {
+        ASSERT(
+            sscanf(strchr(line, ' '), " THREAD %ld LOG %d\n", &thread, &log) == 2
+            && "Log line broken."
+        );
+        ASSERT(thread >= 0 && thread < THREADS && log == last[thread] + 1 && "Logs out of order.");
+        last[thread] = log;
+        ++count;
+    }
+
+    fclose(fp);
+    printf("LOG FILE '%s' lines: %d\n", CLOG_FILE, count);
+    ASSERT(count == THREADS * THREAD_LOGS && "Logs missing.");
+    puts("");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_async_long() {
+
+    char text[CLOG_ASYNC_LINE_MAX + 200];
+    char buf[LINE_BUF_SIZE];
+    char line[LINE_BUF_SIZE];
+    FILE* fp;
+
+    TEST_HEADER(__FUNCTION__);
+
+    memset(text, 'x', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    // Truncated logs keep their color reset and newline.
+    FILL_LINE_BUF_FROM_STDERR(buf, LINE_BUF_SIZE, {
+        CCLOGFLN(RED, "%s", text);
+        CLOGLN("SECOND MARKER");
+        FLOG_FLUSH();
+    });
+    ASSERT(strstr(buf, "x" RESET "\n") && "Color reset or newline cut.");
+    ASSERT(strstr(buf, "\n") < strstr(buf, "SECOND MARKER") && "Logs joined.");
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+    FLOGFLN("%s", text);
+    FLOGLN("SECOND MARKER");
+    FLOG_FLUSH();
+
+    fp = fopen(CLOG_FILE, "r");
+    ASSERT(fp && "Log file not written on flush.");
+    ASSERT(fgets(line, LINE_BUF_SIZE, fp) && "Log missing.");
+    printf("LOG FILE '%s' line length: %zu\n", CLOG_FILE, strlen(line));
+    ASSERT(strlen(line) == CLOG_ASYNC_LINE_MAX && "Log not truncated.");
+    ASSERT(line[CLOG_ASYNC_LINE_MAX - 1] == '\n' && "Newline cut.");
+    ASSERT(fgets(line, LINE_BUF_SIZE, fp) && "Log missing.");
+    ASSERT(strstr(line, "SECOND MARKER\n") && "Logs joined.");
+    fclose(fp);
+    puts("");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_async_tsc() {
+
+    char line[LINE_BUF_SIZE];
+    char last[LINE_BUF_SIZE] = "";
+    char year[8];
+    struct timespec pause = { 0, 2000000 };
+    time_t now = time(NULL);
+    int count = 0;
+    FILE* fp;
+
+    TEST_HEADER(__FUNCTION__);
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+    CLOG_SET_CLOCK(CLOG_CLOCK_TSC);
+
+    // Once the TSC rate is measured, the writer thread formats timestamps.
+    for (int i = 0;  i < THREAD_LOGS;  ++i) {
+        FLOGFLN("TSC LOG %d", i);
+        if (i % 10 == 0)
+            nanosleep(&pause, NULL);
+    }
+
+    FLOG_FLUSH();
+    CLOG_SET_CLOCK(-1);
+
+    fp = fopen(CLOG_FILE, "r");
+    ASSERT(fp && "Log file not written on flush.");
+
+    while (fgets(line, LINE_BUF_SIZE, fp)) {
+        ASSERT(strchr(line, ' ') && "Log line broken.");
+        *strchr(line, ' ') = '\0';
+        ASSERT(strlen(line) > 10 && "Timestamp missing.");
+        ASSERT(strcmp(last, line) <= 0 && "Timestamps out of order.");
+        strcpy(last, line);
+        ++count;
+    }
+
+    fclose(fp);
+    printf("LOG FILE '%s' lines: %d, last timestamp: %s\n", CLOG_FILE, count, last);
+    ASSERT(count == THREAD_LOGS && "Logs missing.");
+    strftime(year, sizeof(year), "%Y", localtime(&now));
+    ASSERT(!strncmp(last, year, 4) && "Timestamp not converted.");
+    #if defined(__x86_64__)
+        ASSERT(_clog_gclock.mult && "TSC rate not measured.");
+    #endif
+    puts("");
+
+    PASS_TEST();
+}
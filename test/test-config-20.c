@@ -0,0 +1,98 @@
+
+#include "test-config-20.h"
+
+
+#define LONG_MSG    "This log is longer than the log line stack buffer."
+
+
+// Function Declarations
+
+static struct test* test_manual_line_overflow_console();
+static struct test* test_manual_line_overflow_file();
+
+
+// Main test function.
+
+struct unit* unit_config_20() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 20 Options");
+
+    ADD_TEST(unit, test_manual_line_overflow_console());
+    ADD_TEST(unit, test_manual_line_overflow_file());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_line_overflow_console() {
+
+    char buf[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    FILL_LINE_BUF_FROM_STDERR(buf, LINE_BUF_SIZE,
+        CCLOGFLN(C_RED, "%s %d", LONG_MSG, 42)
+    );
+    printf("STDERR: %s", buf);
+    ASSERT(
+        strstr(buf, C_RED LONG_MSG " 42" C_RESET "\n")
+        && "Long log not written whole."
+    );
+
+    errno = EACCES;
+    FILL_LINE_BUF_FROM_STDERR(buf, LINE_BUF_SIZE,
+        CTLOG_PERRORF("%s", LONG_MSG)
+    );
+    printf("STDERR: %s", buf);
+    ASSERT(
+        strstr(buf, LONG_MSG ": Permission denied\n")
+        && "Long error log not written whole."
+    );
+    ASSERT(strstr(buf, __FUNCTION__) && "Tracing missing.");
+    puts("");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_line_overflow_file() {
+
+    int fd;
+    char buf[LINE_BUF_SIZE];
+    unsigned char data[32];
+
+    TEST_HEADER(__FUNCTION__);
+
+    for (size_t i = 0;  i < sizeof(data);  ++i)
+        data[i] = (unsigned char) (i * 9);
+
+    unlink(CLOG_FILE);
+    FLOGLN_HEX(data, sizeof(data));
+    FLOGLN_WIDE_HEX(data, 4);
+
+    fd = open(CLOG_FILE, O_RDONLY);
+    ASSERT(fd != -1 && "Failed to open log file.");
+    PRINT_FILE_LINE(fd, buf);
+    ASSERT(
+        strstr(buf,
+            " 0009121b242d363f48515a636c757e879099a2abb4bdc6cfd8e1eaf3fc050e17\n"
+        )
+        && "Long hex log not written whole."
+    );
+    ASSERT(strstr(buf, " 0x00 0x09 0x12 0x1b \n") && "Wide hex log wrong.");
+    close(fd);
+    puts("\n");
+
+    PASS_TEST();
+}
@@ -0,0 +1,14 @@
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "test-macro-helper.h"
+#include "config-20.h"
+#include "clog.h"
+
+
+struct unit* unit_config_20();
+
+
@@ -0,0 +1,162 @@
+
+#include "test-config-21.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_time_precision();
+static struct test* test_manual_time_precision_format();
+static struct test* test_manual_time_clock();
+
+
+// Main test function.
+
+struct unit* unit_config_21() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 21 Options");
+
+    ADD_TEST(unit, test_manual_time_precision());
+    ADD_TEST(unit, test_manual_time_precision_format());
+    ADD_TEST(unit, test_manual_time_clock());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_time_precision() {
+
+    int i = 0;
+    time_t before, after;
+    struct tm tm;
+    char buf[LINE_BUF_SIZE];
+    char prev[LINE_BUF_SIZE] = "";
+    char date[LINE_BUF_SIZE];
+    char zone[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // "%FT%T%z" with microseconds after the seconds.
+    for (i = 0; i < 8; i++) {
+        do {
+            before = time(NULL);
+            FILL_LINE_BUF_FROM_STDERR(
+                buf, LINE_BUF_SIZE, LOGFLN_INFO("TIME %d", i);
+            );
+            after = time(NULL);
+        } while (before != after);
+
+        localtime_r(&before, &tm);
+        strftime(date, LINE_BUF_SIZE, "%FT%T.", &tm);
+        strftime(zone, LINE_BUF_SIZE, "%z ", &tm);
+        printf("STDERR: %s", buf);
+        ASSERT(!strncmp(buf, date, 20) && "Date and time wrong.");
+        ASSERT(strspn(buf + 20, "0123456789") == 6 && "Microseconds wrong.");
+        ASSERT(!strncmp(buf + 26, zone, strlen(zone)) && "Time zone wrong.");
+        ASSERT(
+            strncmp(prev, buf, 26) <= 0 && "Time stamps out of order."
+        );
+        strcpy(prev, buf);
+    }
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_time_clock() {
+
+    int clock = 0;
+    time_t now;
+    struct tm tm;
+    char buf[LINE_BUF_SIZE];
+    char date[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    ASSERT(CLOG_GET_CLOCK() == CLOG_CLOCK && "Default clock wrong.");
+
+    // Wall time clocks keep the date and time layout.
+    for (clock = CLOG_CLOCK_REALTIME; clock <= CLOG_CLOCK_TSC; clock++) {
+        CLOG_SET_CLOCK(clock);
+        ASSERT(CLOG_GET_CLOCK() == clock && "Clock not set.");
+        FILL_LINE_BUF_FROM_STDERR(
+            buf, LINE_BUF_SIZE, LOGFLN_INFO("CLOCK %d", clock);
+        );
+        now = time(NULL);
+        localtime_r(&now, &tm);
+        strftime(date, LINE_BUF_SIZE, "%FT%H:", &tm);
+        printf("STDERR: %s", buf);
+        ASSERT(!strncmp(buf, date, strlen(date)) && "Date wrong.");
+        ASSERT(buf[19] == '.' && "Fraction missing.");
+        ASSERT(strspn(buf + 20, "0123456789") == 6 && "Microseconds wrong.");
+    }
+
+    // Uptime is seconds since the first log.
+    CLOG_SET_CLOCK(CLOG_CLOCK_UPTIME);
+    FILL_LINE_BUF_FROM_STDERR(
+        buf, LINE_BUF_SIZE, LOGFLN_INFO("UPTIME");
+    );
+    printf("STDERR: %s", buf);
+    ASSERT(strspn(buf, "0123456789") < 6 && "Uptime too long.");
+    ASSERT(buf[strspn(buf, "0123456789")] == '.' && "Uptime fraction missing.");
+    ASSERT(
+        strspn(buf + strspn(buf, "0123456789") + 1, "0123456789") == 6
+        && "Uptime microseconds wrong."
+    );
+
+    CLOG_SET_CLOCK(-1);
+    ASSERT(CLOG_GET_CLOCK() == CLOG_CLOCK && "Clock not reset.");
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+#undef CLOG_TIME_FORMAT
+#define CLOG_TIME_FORMAT    "%Y|%H:%M:%S|%%S"
+
+static struct test* test_manual_time_precision_format() {
+
+    time_t before, after;
+    struct tm tm;
+    char buf[LINE_BUF_SIZE];
+    char head[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // Other formats get the fraction after the first seconds.
+    do {
+        before = time(NULL);
+        FILL_LINE_BUF_FROM_STDERR(
+            buf, LINE_BUF_SIZE, LOGFLN_INFO("FORMAT");
+        );
+        after = time(NULL);
+    } while (before != after);
+
+    localtime_r(&before, &tm);
+    strftime(head, LINE_BUF_SIZE, "%Y|%H:%M:%S.", &tm);
+    printf("STDERR: %s", buf);
+    ASSERT(!strncmp(buf, head, strlen(head)) && "Time wrong.");
+    ASSERT(
+        strspn(buf + strlen(head), "0123456789") == 6
+        && "Microseconds wrong."
+    );
+    ASSERT(
+        !strncmp(buf + strlen(head) + 6, "|%S ", 4)
+        && "Rest of time format wrong."
+    );
+    puts("\n");
+
+    PASS_TEST();
+}
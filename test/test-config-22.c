@@ -0,0 +1,80 @@
+#include "test-config-22.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_hexdump_max();
+
+
+// Main test function.
+
+struct unit* unit_config_22() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 22 Options");
+
+    ADD_TEST(unit, test_manual_hexdump_max());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_hexdump_max() {
+
+    int fd = 0;
+    unsigned char data[40];
+    char buf[LINE_BUF_SIZE];
+    char file_buf[LINE_BUF_SIZE];
+    const char* rows =
+        "00000000  30 31 32 33 34 35 36 37  38 39 3a 3b 3c 3d 3e 3f  "
+        "|0123456789:;<=>?|\n"
+        "00000010  40 41 42 43 44 45 46 47  48 49 4a 4b 4c 4d 4e 4f  "
+        "|@ABCDEFGHIJKLMNO|\n"
+        "... 8 more bytes\n";
+    size_t i;
+
+    TEST_HEADER(__FUNCTION__);
+
+    for (i = 0;  i < sizeof(data);  ++i)
+        data[i] = (unsigned char) ('0' + i);
+
+    // Need to delete log file.
+    unlink(LOG_FILENAME);
+    LOGLN("Test creation.");
+
+    fd = open(LOG_FILENAME, O_RDONLY);
+    ASSERT(fd);
+    lseek(fd, 0, SEEK_END);
+
+    // Only CLOG_HEXDUMP_MAX bytes are dumped, for both console and file.
+    FILL_LINE_BUF_FROM_STDERR(
+        buf, LINE_BUF_SIZE, LOG_HEXDUMP_INFO(data, sizeof(data));
+    );
+    printf("STDERR: %s", buf);
+    PRINT_FILE_LINE(fd, file_buf);
+    ASSERT(
+        strstr(buf, C_INFO CLOG_SYM_INFO " 40 bytes" C_RESET "\n")
+        && "Console hex dump header wrong."
+    );
+    ASSERT(
+        strstr(file_buf, " " CLOG_SYM_INFO " 40 bytes\n")
+        && "File hex dump header wrong."
+    );
+    ASSERT(strstr(buf, rows) && "Console hex dump rows wrong.");
+    ASSERT(strstr(file_buf, rows) && "File hex dump rows wrong.");
+    ASSERT(!strstr(file_buf, C_INFO) && "Color found in log.");
+    close(fd);
+    puts("\n");
+
+    PASS_TEST();
+}
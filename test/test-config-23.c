@@ -0,0 +1,98 @@
+
+#include "test-config-23.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_percent_separators();
+
+
+// Main test function.
+
+struct unit* unit_config_23() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 23 Options");
+
+    ADD_TEST(unit, test_manual_percent_separators());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static struct test* test_manual_percent_separators() {
+
+    int fd = 0;
+    int i;
+    int line;
+    char buf[LINE_BUF_SIZE];
+    char file_buf[LINE_BUF_SIZE];
+    char tracing[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // Need to delete log file.
+    unlink(LOG_FILENAME);
+    LOGLN("Test creation.");
+
+    fd = open(LOG_FILENAME, O_RDONLY);
+    ASSERT(fd);
+    lseek(fd, 0, SEEK_END);
+
+    // Separators are printed as is, twice to check the call site header.
+    for (i = 0;  i < 2;  ++i) {
+        line = __LINE__ + 2;
+        FILL_LINE_BUF_FROM_STDERR(
+            buf, LINE_BUF_SIZE, LOGFLN_DEBUG("value %d", 42);
+        );
+        printf("STDERR: %s", buf);
+        PRINT_FILE_LINE(fd, file_buf);
+        snprintf(
+            tracing, sizeof(tracing), "test-config-23.c%%s%s%%s%d %%d%%%% ",
+            __FUNCTION__, line
+        );
+        ASSERT(strstr(file_buf, tracing) && "File tracing wrong.");
+        ASSERT(
+            strstr(file_buf, CLOG_SYM_DEBUG " %d%% value 42\n")
+            && "File line header wrong."
+        );
+        ASSERT(strstr(buf, "%s") && "Console tracing wrong.");
+        ASSERT(
+            strstr(buf, CLOG_SYM_DEBUG " %d%% value 42" C_RESET "\n")
+            && "Console line header wrong."
+        );
+    }
+
+    FILL_LINE_BUF_FROM_STDERR(
+        buf, LINE_BUF_SIZE, CLOGF_INFO("value %d\n", 7);
+    );
+    printf("STDERR: %s", buf);
+    ASSERT(
+        strstr(buf, CLOG_SYM_INFO " %d%% value 7\n")
+        && "Console line header wrong."
+    );
+
+    FILL_LINE_BUF_FROM_STDOUT(
+        buf, LINE_BUF_SIZE, PRINTFLN_WARNING("value %d", 3);
+    );
+    printf("STDOUT: %s", buf);
+    ASSERT(
+        !strcmp(buf, CLOG_SYM_WARNING " %d%% value 3\n")
+        && "Print line header wrong."
+    );
+    close(fd);
+    puts("\n");
+
+    PASS_TEST();
+}
+
@@ -0,0 +1,102 @@
+
+#include "test-config-24.h"
+
+
+#define THREADS         16
+#define THREAD_LOGS     100
+#define LONG_LOG        6000
+
+
+// Function Declarations
+
+static struct test* test_manual_thread_safe_lines();
+
+
+// Main test function.
+
+struct unit* unit_config_24() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 24 Options");
+
+    ADD_TEST(unit, test_manual_thread_safe_lines());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static char long_log[LONG_LOG + 1];
+
+static void* log_thread(void* arg) {
+
+    for (int i = 0;  i < THREAD_LOGS;  ++i)
+        FLOGFLN_INFO("THREAD %ld LOG %d %s", (long) arg, i, long_log);
+
+    return NULL;
+}
+
+static struct test* test_manual_thread_safe_lines() {
+
+    pthread_t threads[THREADS];
+    static char line[LONG_LOG * 2];
+    int last[THREADS];
+    int count = 0;
+    long thread;
+    int log;
+    char* text;
+    FILE* fp;
+
+    TEST_HEADER(__FUNCTION__);
+
+    memset(long_log, 'x', LONG_LOG);
+    unlink(CLOG_FILE);
+
+    for (long i = 0;  i < THREADS;  ++i)
+        pthread_create(&threads[i], NULL, log_thread, (void*) i);
+
+    for (int i = 0;  i < THREADS;  ++i) {
+        pthread_join(threads[i], NULL);
+        last[i] = -1;
+    }
+
+    // Logs longer than the stdio buffer are still whole.
+    fp = fopen(CLOG_FILE, "r");
+    ASSERT(fp && "Log file not written.");
+
+    while (fgets(line, sizeof(line), fp)) {
+        text = strstr(line, CLOG_SYM_INFO " THREAD ");
+        ASSERT(
+            text
+            && sscanf(
+                text + strlen(CLOG_SYM_INFO), " THREAD %ld LOG %d ",
+                &thread, &log
+            ) == 2
+            && "Log line broken."
+        );
+        ASSERT(thread >= 0 && thread < THREADS && log == last[thread] + 1 && "Logs out of order.");
+        ASSERT(
+            strlen(strchr(text, 'x')) == LONG_LOG + 1
+            && "Log line broken."
+        );
+        last[thread] = log;
+        ++count;
+    }
+
+    fclose(fp);
+    printf("LOG FILE '%s' lines: %d\n", CLOG_FILE, count);
+    ASSERT(count == THREADS * THREAD_LOGS && "Logs missing.");
+    puts("");
+
+    PASS_TEST();
+}
+
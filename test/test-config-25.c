@@ -0,0 +1,92 @@
+
+#include "test-config-25.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_log_buffers();
+
+
+// Main test function.
+
+struct unit* unit_config_25() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 25 Options");
+
+    ADD_TEST(unit, test_manual_log_buffers());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines() {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        ++count;
+
+    fclose(fp);
+    return count;
+}
+
+static void* log_thread(void* arg) {
+
+    (void) arg;
+    FLOGFLN_INFO("THREAD LOG");
+
+    return NULL;
+}
+
+static struct test* test_manual_log_buffers() {
+
+    pthread_t thread;
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+
+    // Logs below the flush level stay in the buffer.
+    FLOGFLN_INFO("INFO LOG 1");
+    FLOGFLN_EXTRA("EXTRA LOG 2");
+    ASSERT(log_file_lines() == 0 && "Buffered logs written.");
+
+    // A warning log writes the buffer with itself.
+    FLOGFLN_WARNING("WARNING LOG 3");
+    ASSERT(log_file_lines() == 3 && "Buffer not written on warning log.");
+
+    // FLOG_FLUSH() writes the buffer of the calling thread.
+    FLOGFLN_INFO("INFO LOG 4");
+    ASSERT(log_file_lines() == 3 && "Buffered logs written.");
+    FLOG_FLUSH();
+    ASSERT(log_file_lines() == 4 && "Buffer not written on flush.");
+
+    // Exiting threads write their buffer.
+    pthread_create(&thread, NULL, log_thread, NULL);
+    pthread_join(thread, NULL);
+    printf("LOG FILE '%s' lines: %d\n", CLOG_FILE, log_file_lines());
+    ASSERT(log_file_lines() == 5 && "Buffer not written at thread exit.");
+    puts("");
+
+    PASS_TEST();
+}
+
+
@@ -0,0 +1,115 @@
+
+#include "test-config-26.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_runtime_level();
+static struct test* test_manual_runtime_level_env();
+
+
+// Main test function.
+
+struct unit* unit_config_26() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 26 Options");
+
+    ADD_TEST(unit, test_manual_runtime_level());
+    ADD_TEST(unit, test_manual_runtime_level_env());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines() {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        ++count;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_manual_runtime_level() {
+
+    int calls = 0;
+    unsigned char data[4] = {0};
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_ALL && "Wrong default level.");
+
+    // Disabled logs do not evaluate their arguments.
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_WARNING && "Level not set.");
+    FLOGFLN_INFO("INFO LOG %d", ++calls);
+    FLOGFLN_TRACE("TRACE LOG %d", ++calls);
+    LOG_HEXDUMP_INFO(data, (++calls, sizeof(data)));
+    ASSERT(calls == 0 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines() == 0 && "Disabled logs written.");
+
+    // Enabled logs are written.
+    FLOGFLN_WARNING("WARNING LOG %d", ++calls);
+    FLOGFLN_ERROR("ERROR LOG %d", ++calls);
+    ASSERT(calls == 2 && "Enabled log arguments not evaluated.");
+    ASSERT(log_file_lines() == 2 && "Enabled logs not written.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_NONE);
+    FLOGFLN_FATAL("FATAL LOG %d", ++calls);
+    ASSERT(calls == 2 && log_file_lines() == 2 && "Log written at none.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    FLOGFLN_TRACE("TRACE LOG %d", ++calls);
+    ASSERT(calls == 3 && log_file_lines() == 3 && "Log not written at all.");
+    puts("");
+
+    PASS_TEST();
+}
+
+static struct test* test_manual_runtime_level_env() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    _clog_level_env_set("Debug");
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_DEBUG && "Level name not read.");
+
+    _clog_level_env_set("2");
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_ERROR && "Level number not read.");
+
+    _clog_level_env_set("verbose");
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_ERROR && "Bad level read.");
+
+    // C files loaded later do not reset the level set at runtime.
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    setenv(CLOG_LEVEL_ENV, "debug", 1);
+    _clog_level_env();
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_WARNING && "Level reset.");
+
+    unsetenv(CLOG_LEVEL_ENV);
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    PASS_TEST();
+}
+
+
@@ -0,0 +1,151 @@
+
+#include <pthread.h>
+#include "test-config-27.h"
+
+
+#define THREADS         4
+#define SWITCHES        500
+
+
+// Function Declarations
+
+static struct test* test_manual_static_keys();
+static struct test* test_manual_static_keys_threads();
+
+
+// Main test function.
+
+struct unit* unit_config_27() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 27 Options");
+
+    ADD_TEST(unit, test_manual_static_keys());
+    ADD_TEST(unit, test_manual_static_keys_threads());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines() {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        ++count;
+
+    fclose(fp);
+    return count;
+}
+
+static int static_key_jumps() {
+
+    struct _clog_key* key;
+    int count = 0;
+
+    for (key = __start___clog_keys;  key < __stop___clog_keys;  ++key)
+        count += *(unsigned char*) key->code == _CLOG_KEY_JMP;
+
+    return count;
+}
+
+static struct test* test_manual_static_keys() {
+
+    int keys;
+    int calls = 0;
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    keys = __stop___clog_keys - __start___clog_keys;
+    printf("Static keys: %d\n", keys);
+    ASSERT(keys == 6 && "Log level functions not recorded.");
+    ASSERT(static_key_jumps() == keys && "Static keys not enabled.");
+
+    // Disabled levels are turned into no-ops.
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    ASSERT(static_key_jumps() == 2 && "Static keys not rewritten.");
+    FLOGFLN_DEBUG("DEBUG LOG %d", ++calls);
+    FLOGFLN_WARNING("WARNING LOG %d", ++calls);
+    ASSERT(calls == 1 && log_file_lines() == 1 && "Wrong logs written.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_NONE);
+    ASSERT(static_key_jumps() == 0 && "Static keys not rewritten.");
+    FLOGFLN_FATAL("FATAL LOG %d", ++calls);
+    ASSERT(calls == 1 && log_file_lines() == 1 && "Log written at none.");
+
+    // Enabled levels jump into their logs again.
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    ASSERT(static_key_jumps() == keys && "Static keys not enabled.");
+    FLOGFLN_DEBUG("DEBUG LOG %d", ++calls);
+    ASSERT(calls == 2 && log_file_lines() == 2 && "Log not written.");
+    puts("");
+
+    PASS_TEST();
+}
+
+
+
+
+static int stop;
+
+static void* log_thread(void* arg) {
+
+    (void) arg;
+
+    while (!__atomic_load_n(&stop, __ATOMIC_RELAXED))
+        FLOGFLN_TRACE("TRACE LOG");
+
+    return NULL;
+}
+
+static struct test* test_manual_static_keys_threads() {
+
+    pthread_t threads[THREADS];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // Jumps are rewritten while other threads run them.
+    for (int i = 0;  i < THREADS;  ++i)
+        pthread_create(&threads[i], NULL, log_thread, NULL);
+
+    for (int i = 0;  i < SWITCHES;  ++i)
+        CLOG_SET_LEVEL(i & 1 ? CLOG_LEVEL_ALL : CLOG_LEVEL_WARNING);
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    __atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+
+    for (int i = 0;  i < THREADS;  ++i)
+        pthread_join(threads[i], NULL);
+
+    ASSERT(static_key_jumps() == 2 && "Static keys not rewritten.");
+    unlink(CLOG_FILE);
+    FLOGFLN_TRACE("TRACE LOG");
+    ASSERT(log_file_lines() == 0 && "Disabled log written.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    ASSERT(
+        static_key_jumps() == __stop___clog_keys - __start___clog_keys
+        && "Static keys not enabled."
+    );
+    puts("");
+
+    PASS_TEST();
+}
@@ -0,0 +1,15 @@
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "test.h"
+#include "test-macro-helper.h"
+#include "config-27.h"
+#include "clog.h"
+
+
+struct unit* unit_config_27();
+
+
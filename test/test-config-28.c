@@ -0,0 +1,177 @@
+
+#include "test-config-28.h"
+
+
+// Function Declarations
+
+static struct test* test_manual_call_site_control();
+static struct test* test_manual_call_site_file();
+static struct test* test_manual_call_site_file_long();
+
+
+// Main test function.
+
+struct unit* unit_config_28() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 28 Options");
+
+    ADD_TEST(unit, test_manual_call_site_control());
+    ADD_TEST(unit, test_manual_call_site_file());
+    ADD_TEST(unit, test_manual_call_site_file_long());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+
+static void parse_site() {
+
+    FLOGFLN_DEBUG("PARSE LOG %d", ++calls);
+}
+
+static void connect_site() {
+
+    FLOGFLN_DEBUG("CONNECT DEBUG LOG %d", ++calls);
+    FLOGFLN_INFO("CONNECT INFO LOG %d", ++calls);
+}
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_manual_call_site_control() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    // Call sites follow the runtime log level.
+    parse_site();
+    connect_site();
+    ASSERT(calls == 1 && "Disabled call site arguments evaluated.");
+    ASSERT(log_file_lines("CONNECT INFO LOG") == 1 && "Log not written.");
+
+    // One call site is enabled by function and level.
+    ASSERT(
+        CLOG_SITES_CONTROL("func connect_* level debug +p") == 1
+        && "Wrong call sites matched."
+    );
+    parse_site();
+    connect_site();
+    ASSERT(log_file_lines("PARSE LOG") == 0 && "Disabled call site logged.");
+    ASSERT(log_file_lines("CONNECT DEBUG LOG") == 1 && "Call site not enabled.");
+
+    // Call sites are disabled by file and line range.
+    ASSERT(
+        CLOG_SITES_CONTROL("file test-config-2?.c line 42-47 -p") == 2
+        && "Wrong call sites matched."
+    );
+    connect_site();
+    ASSERT(log_file_lines("CONNECT INFO LOG") == 2 && "Call site not disabled.");
+
+    ASSERT(CLOG_SITES_CONTROL("level debug") == -1 && "Bad query applied.");
+    ASSERT(CLOG_SITES_CONTROL("file *.c =_") == 3 && "Call sites not reset.");
+    CLOG_SITES_LIST(stdout);
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    puts("");
+
+    PASS_TEST();
+}
+
+static struct test* test_manual_call_site_file() {
+
+    FILE* fp;
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    fp = fopen(CLOG_CALL_SITES_FILE, "w");
+    ASSERT(fp && "Control file not written.");
+    fputs("# Control file\nfunc parse_site -p; func connect_site -p\n", fp);
+    fclose(fp);
+
+    // The control file is applied on the signal.
+    raise(CLOG_CALL_SITES_SIGNAL);
+    parse_site();
+    connect_site();
+    ASSERT(log_file_lines("LOG") == 0 && "Call sites not disabled.");
+
+    ASSERT(CLOG_SITES_CONTROL("=_") == 3 && "Call sites not reset.");
+    parse_site();
+    ASSERT(log_file_lines("PARSE LOG") == 1 && "Call site not reset.");
+    unlink(CLOG_CALL_SITES_FILE);
+
+    PASS_TEST();
+}
+
+
+
+static struct test* test_manual_call_site_file_long() {
+
+    FILE* fp;
+    int i;
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    fp = fopen(CLOG_CALL_SITES_FILE, "w");
+    ASSERT(fp && "Control file not written.");
+
+    for (i = 0;  i < 300;  i++)
+        fprintf(fp, "# Comment line %d of a long control file\n", i);
+
+    fputs("func parse_site -p", fp);
+    fclose(fp);
+
+    // Queries after the first 4096 bytes are applied.
+    ASSERT(CLOG_SITES_LOAD(CLOG_CALL_SITES_FILE) == 1 && "Wrong call sites matched.");
+    parse_site();
+    ASSERT(log_file_lines("PARSE LOG") == 0 && "Call site not disabled.");
+
+    // A line too long for the buffer is invalid, the next lines still apply.
+    fp = fopen(CLOG_CALL_SITES_FILE, "w");
+    ASSERT(fp && "Control file not written.");
+    fputs("func ", fp);
+
+    for (i = 0;  i < 5000;  i++)
+        fputc('x', fp);
+
+    fputs(" -p\nfunc parse_site +p\n", fp);
+    fclose(fp);
+
+    ASSERT(CLOG_SITES_LOAD(CLOG_CALL_SITES_FILE) == -1 && "Long line applied.");
+    parse_site();
+    ASSERT(log_file_lines("PARSE LOG") == 1 && "Call site not enabled.");
+
+    ASSERT(CLOG_SITES_CONTROL("=_") == 3 && "Call sites not reset.");
+    unlink(CLOG_CALL_SITES_FILE);
+
+    PASS_TEST();
+}
@@ -0,0 +1,16 @@
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <signal.h>
+#include "test.h"
+#include "test-macro-helper.h"
+#include "config-28.h"
+#include "clog.h"
+
+
+struct unit* unit_config_28();
+
+
@@ -0,0 +1,72 @@
+
+#include "test-config-29.h"
+
+
+// Function Declarations
+
+static struct test* test_module_level();
+
+
+// Main test function.
+
+struct unit* unit_config_29() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 29 Options");
+
+    ADD_TEST(unit, test_module_level());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_module_level() {
+
+    int calls = 0;
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+
+    // The "packet" module level replaces CLOG_LEVEL_INFO.
+    ASSERT(CLOG_LEVEL == CLOG_LEVEL_WARNING && "Module level not applied.");
+    ASSERT(CLOG_LEVEL_NONE == 0 && "CLOG_LEVEL_NONE not restored.");
+
+    // Levels above the module level are compiled out.
+    FLOGFLN_INFO("MODULE INFO LOG %d", ++calls);
+    FLOGFLN_DEBUG("MODULE DEBUG LOG %d", ++calls);
+    FLOGFLN_WARNING("MODULE WARNING LOG %d", ++calls);
+    ASSERT(calls == 1 && "Compiled out log arguments evaluated.");
+    ASSERT(log_file_lines("MODULE INFO LOG") == 0 && "Info log written.");
+    ASSERT(log_file_lines("MODULE WARNING LOG") == 1 && "Log not written.");
+
+    PASS_TEST();
+}
@@ -0,0 +1,16 @@
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "test.h"
+#include "test-macro-helper.h"
+#define CLOG_MODULE packet
+#include "config-29.h"
+#include "clog.h"
+
+
+struct unit* unit_config_29();
+
+
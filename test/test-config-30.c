@@ -0,0 +1,113 @@
+
+#include "test-config-30.h"
+
+
+// Function Declarations
+
+static struct test* test_level_mask();
+static struct test* test_runtime_level_mask();
+
+
+// Main test function.
+
+struct unit* unit_config_30() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 30 Options");
+
+    ADD_TEST(unit, test_level_mask());
+    ADD_TEST(unit, test_runtime_level_mask());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+
+static void log_levels() {
+
+    FLOGFLN_TRACE("MASK TRACE LOG %d", ++calls);
+    FLOGFLN_DEBUG("MASK DEBUG LOG %d", ++calls);
+    FLOGFLN_WARNING("MASK WARNING LOG %d", ++calls);
+    FLOGFLN_ERROR("MASK ERROR LOG %d", ++calls);
+}
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_level_mask() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Levels that are not in the mask are compiled out.
+    log_levels();
+    ASSERT(calls == 2 && "Compiled out log arguments evaluated.");
+    ASSERT(log_file_lines("MASK TRACE LOG") == 1 && "Trace log not written.");
+    ASSERT(log_file_lines("MASK DEBUG LOG") == 0 && "Debug log written.");
+    ASSERT(log_file_lines("MASK WARNING LOG") == 0 && "Warning log written.");
+    ASSERT(log_file_lines("MASK ERROR LOG") == 1 && "Error log not written.");
+    ASSERT(CLOG_GET_MASK() == CLOG_LEVEL_MASK && "Wrong level mask.");
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_ERROR && "Wrong log level.");
+
+    PASS_TEST();
+}
+
+static struct test* test_runtime_level_mask() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Levels that are not in the runtime mask are skipped.
+    CLOG_SET_MASK(CLOG_MASK_ERROR | CLOG_MASK_DEBUG);
+    log_levels();
+    ASSERT(calls == 1 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("MASK TRACE LOG") == 0 && "Trace log written.");
+    ASSERT(log_file_lines("MASK ERROR LOG") == 1 && "Error log not written.");
+    ASSERT(CLOG_GET_MASK() == CLOG_MASK_ERROR && "Wrong level mask.");
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_NONE && "Wrong log level.");
+
+    // Runtime log levels set the mask of their levels.
+    CLOG_SET_LEVEL(CLOG_LEVEL_CRITICAL);
+    ASSERT(
+        CLOG_GET_MASK() == (CLOG_MASK_CRITICAL | CLOG_MASK_FATAL)
+        && "Wrong level mask."
+    );
+    ASSERT(CLOG_GET_LEVEL() == CLOG_LEVEL_CRITICAL && "Wrong log level.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    log_levels();
+    ASSERT(calls == 3 && "Log arguments not evaluated.");
+    ASSERT(log_file_lines("MASK TRACE LOG") == 1 && "Trace log not written.");
+
+    PASS_TEST();
+}
@@ -0,0 +1,137 @@
+
+#include "test-config-31.h"
+
+
+// Function Declarations
+
+static struct test* test_logger_hierarchy();
+static struct test* test_logger_root();
+
+
+// Loggers
+
+CLOG_DEFINE_LOGGER(net_logger, "net");
+CLOG_DEFINE_LOGGER(tls_logger, "net.tls");
+CLOG_DEFINE_LOGGER(netfilter_logger, "netfilter");
+
+
+// Main test function.
+
+struct unit* unit_config_31() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 31 Options");
+
+    ADD_TEST(unit, test_logger_hierarchy());
+    ADD_TEST(unit, test_logger_root());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+
+static void log_loggers() {
+
+    FLOGFLN_TO(net_logger, DEBUG, "NET DEBUG LOG %d", ++calls);
+    FLOGFLN_TO(tls_logger, DEBUG, "TLS DEBUG LOG %d", ++calls);
+    FLOGFLN_TO(netfilter_logger, DEBUG, "NETFILTER DEBUG LOG %d", ++calls);
+    FLOGFLN_DEBUG("ROOT DEBUG LOG %d", ++calls);
+}
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_logger_hierarchy() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    calls = 0;
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    // "net.tls" inherits the level of "net" but "netfilter" does not.
+    ASSERT(
+        CLOG_SET_LOGGER_LEVEL("net", CLOG_LEVEL_DEBUG) == 0
+        && "Logger level not set."
+    );
+    log_loggers();
+    ASSERT(calls == 2 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("net: NET DEBUG LOG") == 1 && "Log not written.");
+    ASSERT(
+        log_file_lines("net.tls: TLS DEBUG LOG") == 1 && "Log not written."
+    );
+    ASSERT(log_file_lines("NETFILTER DEBUG LOG") == 0 && "Log written.");
+    ASSERT(log_file_lines("ROOT DEBUG LOG") == 0 && "Log written.");
+
+    // A level of its own overrides the inherited level.
+    CLOG_SET_LOGGER_MASK("net.tls", CLOG_MASK_ERROR);
+    ASSERT(
+        CLOG_GET_LOGGER_MASK(tls_logger) == CLOG_MASK_ERROR
+        && "Wrong logger mask."
+    );
+    log_loggers();
+    ASSERT(calls == 3 && "Disabled log arguments evaluated.");
+
+    // Reset loggers inherit again.
+    CLOG_RESET_LOGGER_LEVEL("net.tls");
+    CLOG_RESET_LOGGER_LEVEL("net");
+    ASSERT(
+        CLOG_GET_LOGGER_MASK(tls_logger) == CLOG_GET_MASK()
+        && "Wrong logger mask."
+    );
+    log_loggers();
+    ASSERT(calls == 3 && "Disabled log arguments evaluated.");
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    PASS_TEST();
+}
+
+static struct test* test_logger_root() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Loggers without levels follow the runtime log level of the root.
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    ASSERT(
+        CLOG_GET_LOGGER_MASK(net_logger) == CLOG_GET_MASK()
+        && "Wrong logger mask."
+    );
+    log_loggers();
+    ASSERT(calls == 0 && "Disabled log arguments evaluated.");
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    log_loggers();
+    ASSERT(calls == 4 && "Log arguments not evaluated.");
+    ASSERT(log_file_lines("DEBUG LOG") == 4 && "Logs not written.");
+
+    PASS_TEST();
+}
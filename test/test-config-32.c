@@ -0,0 +1,159 @@
+
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "test-config-32.h"
+
+
+// Function Declarations
+
+static struct test* test_thread_level();
+static struct test* test_thread_level_of();
+
+
+// Main test function.
+
+struct unit* unit_config_32() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 32 Options");
+
+    ADD_TEST(unit, test_thread_level());
+    ADD_TEST(unit, test_thread_level_of());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+static long worker_tid = 0;
+static pthread_barrier_t ready;
+static pthread_barrier_t raised;
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static void* debug_worker(void* arg) {
+
+    (void) arg;
+
+    CLOG_SET_THREAD_LEVEL(CLOG_LEVEL_DEBUG);
+    FLOGFLN_DEBUG("WORKER DEBUG LOG %d", __atomic_add_fetch(&calls, 1, 0));
+    FLOGFLN_TRACE("WORKER TRACE LOG %d", __atomic_add_fetch(&calls, 1, 0));
+
+    return NULL;
+}
+
+static void* tid_worker(void* arg) {
+
+    (void) arg;
+
+    // Register the thread with its first log before its level is raised.
+    worker_tid = (long) syscall(SYS_gettid);
+    FLOGFLN_WARNING("WORKER WARNING LOG");
+    pthread_barrier_wait(&ready);
+    pthread_barrier_wait(&raised);
+    FLOGFLN_DEBUG("WORKER DEBUG LOG %d", __atomic_add_fetch(&calls, 1, 0));
+
+    return NULL;
+}
+
+static struct test* test_thread_level() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    pthread_t thread;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    // Only the thread that raised its level logs debug.
+    pthread_create(&thread, NULL, debug_worker, NULL);
+    pthread_join(thread, NULL);
+    FLOGFLN_DEBUG("MAIN DEBUG LOG %d", ++calls);
+    ASSERT(calls == 1 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("WORKER DEBUG LOG") == 1 && "Log not written.");
+    ASSERT(log_file_lines("MAIN DEBUG LOG") == 0 && "Log written.");
+
+    // The calling thread raises and clears its own level.
+    ASSERT(
+        CLOG_SET_THREAD_MASK(CLOG_MASK_TRACE) == 0
+        && "Thread mask not set."
+    );
+    FLOGFLN_TRACE("MAIN TRACE LOG %d", ++calls);
+    CLOG_SET_THREAD_LEVEL(CLOG_LEVEL_NONE);
+    FLOGFLN_TRACE("MAIN TRACE LOG %d", ++calls);
+    ASSERT(calls == 2 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("MAIN TRACE LOG") == 1 && "Log not written.");
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    PASS_TEST();
+}
+
+static struct test* test_thread_level_of() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    pthread_t thread;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+    pthread_barrier_init(&ready, NULL, 2);
+    pthread_barrier_init(&raised, NULL, 2);
+
+    // Raise the level of another thread by its thread ID.
+    ASSERT(
+        CLOG_SET_THREAD_LEVEL_OF(-2, CLOG_LEVEL_DEBUG) == -1
+        && "Unknown thread level set."
+    );
+    pthread_create(&thread, NULL, tid_worker, NULL);
+    pthread_barrier_wait(&ready);
+    ASSERT(
+        CLOG_SET_THREAD_LEVEL_OF(worker_tid, CLOG_LEVEL_DEBUG) == 0
+        && "Thread level not set."
+    );
+    pthread_barrier_wait(&raised);
+    pthread_join(thread, NULL);
+    FLOGFLN_DEBUG("MAIN DEBUG LOG %d", ++calls);
+    ASSERT(calls == 1 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("WORKER DEBUG LOG") == 1 && "Log not written.");
+    ASSERT(log_file_lines("MAIN DEBUG LOG") == 0 && "Log written.");
+
+    // Exited threads are no longer registered.
+    ASSERT(
+        CLOG_SET_THREAD_LEVEL_OF(worker_tid, CLOG_LEVEL_DEBUG) == -1
+        && "Exited thread level set."
+    );
+
+    pthread_barrier_destroy(&ready);
+    pthread_barrier_destroy(&raised);
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    PASS_TEST();
+}
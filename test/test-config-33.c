@@ -0,0 +1,146 @@
+
+#include <unistd.h>
+#include "test-config-33.h"
+
+
+// Function Declarations
+
+static struct test* test_rate_limit_burst();
+static struct test* test_rate_limit_suppressed();
+static struct test* test_rate_limit_edges();
+
+
+// Main test function.
+
+struct unit* unit_config_33() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 33 Options");
+
+    ADD_TEST(unit, test_rate_limit_burst());
+    ADD_TEST(unit, test_rate_limit_suppressed());
+    ADD_TEST(unit, test_rate_limit_edges());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_rate_limit_burst() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Only the burst is logged and suppressed logs are not evaluated.
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(ERROR, 0.001, 3, "BURST ERROR LOG %d", ++calls);
+
+    ASSERT(calls == 3 && "Suppressed log arguments evaluated.");
+    ASSERT(log_file_lines("BURST ERROR LOG") == 3 && "Logs not written.");
+
+    // Disabled levels take no tokens.
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(DEBUG, 0.001, 1, "BURST DEBUG LOG %d", ++calls);
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+    ASSERT(calls == 3 && "Disabled log arguments evaluated.");
+    ASSERT(log_file_lines("suppressed") == 0 && "Suppressed logs reported.");
+
+    PASS_TEST();
+}
+
+static struct test* test_rate_limit_suppressed() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // The first log after the bucket refills reports the suppressed logs.
+    for (i = 0;  i < 6;  i++) {
+        if (i == 5)
+            usleep(100000);
+
+        FLOGFLN_RL(WARNING, 20, 1, "REFILL WARNING LOG %d", ++calls);
+    }
+
+    ASSERT(calls == 2 && "Suppressed log arguments evaluated.");
+    ASSERT(log_file_lines("REFILL WARNING LOG") == 2 && "Logs not written.");
+    ASSERT(
+        log_file_lines("suppressed 4 similar messages") == 1
+        && "Suppressed logs not reported."
+    );
+
+    PASS_TEST();
+}
+
+static struct test* test_rate_limit_edges() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // A rate of zero or below only logs the burst.
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(ERROR, 0, 2, "ZERO RATE LOG %d", ++calls);
+
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(ERROR, -1, 1, "NEGATIVE RATE LOG %d", ++calls);
+
+    ASSERT(calls == 3 && "Suppressed log arguments evaluated.");
+    ASSERT(log_file_lines("ZERO RATE LOG") == 2 && "Zero rate burst wrong.");
+    ASSERT(log_file_lines("NEGATIVE RATE LOG") == 1 && "Negative rate burst wrong.");
+
+    // A burst below one is taken as one.
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(ERROR, 0.001, 0, "ZERO BURST LOG %d", ++calls);
+
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_RL(ERROR, 0.001, -5, "NEGATIVE BURST LOG %d", ++calls);
+
+    ASSERT(calls == 5 && "Suppressed log arguments evaluated.");
+    ASSERT(log_file_lines("ZERO BURST LOG") == 1 && "Zero burst wrong.");
+    ASSERT(log_file_lines("NEGATIVE BURST LOG") == 1 && "Negative burst wrong.");
+
+    PASS_TEST();
+}
@@ -0,0 +1,116 @@
+
+#include <unistd.h>
+#include "test-config-34.h"
+
+
+// Function Declarations
+
+static struct test* test_sample_first();
+static struct test* test_sample_every();
+
+
+// Main test function.
+
+struct unit* unit_config_34() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 34 Options");
+
+    ADD_TEST(unit, test_sample_first());
+    ADD_TEST(unit, test_sample_every());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int calls = 0;
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_sample_first() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Skipped occurrences are not evaluated.
+    for (i = 0;  i < 10;  i++) {
+        FLOGFLN_ONCE(INFO, "ONCE INFO LOG %d", ++calls);
+        FLOGFLN_FIRST_N(ERROR, 3, "FIRST ERROR LOG %d", ++calls);
+    }
+
+    ASSERT(calls == 4 && "Skipped log arguments evaluated.");
+    ASSERT(log_file_lines("ONCE INFO LOG") == 1 && "Logs not written.");
+    ASSERT(log_file_lines("FIRST ERROR LOG") == 3 && "Logs not written.");
+    ASSERT(log_file_lines("#3: FIRST ERROR LOG") == 1 && "Wrong occurrence.");
+
+    // Disabled levels are not counted.
+    CLOG_SET_LEVEL(CLOG_LEVEL_INFO);
+
+    for (i = 0;  i < 2;  i++)
+        FLOGFLN_FIRST_N(DEBUG, 1, "FIRST DEBUG LOG %d", ++calls);
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    for (i = 0;  i < 2;  i++)
+        FLOGFLN_FIRST_N(DEBUG, 1, "FIRST DEBUG LOG %d", ++calls);
+
+    ASSERT(calls == 5 && "Skipped log arguments evaluated.");
+    ASSERT(log_file_lines("#1: FIRST DEBUG LOG") == 1 && "Wrong occurrence.");
+
+    PASS_TEST();
+}
+
+static struct test* test_sample_every() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+    calls = 0;
+
+    // Every 4th occurrence starting with the first.
+    for (i = 0;  i < 10;  i++)
+        FLOGFLN_EVERY_N(WARNING, 4, "EVERY WARNING LOG %d", ++calls);
+
+    ASSERT(calls == 3 && "Skipped log arguments evaluated.");
+    ASSERT(log_file_lines("EVERY WARNING LOG") == 3 && "Logs not written.");
+    ASSERT(
+        log_file_lines("#1: EVERY WARNING LOG") == 1
+        && log_file_lines("#5: EVERY WARNING LOG") == 1
+        && log_file_lines("#9: EVERY WARNING LOG") == 1
+        && "Wrong occurrences."
+    );
+
+    PASS_TEST();
+}
@@ -0,0 +1,178 @@
+
+#include <pthread.h>
+#include <unistd.h>
+#include "test-config-35.h"
+
+
+// Function Declarations
+
+static struct test* test_dedup_run();
+static struct test* test_dedup_window();
+static struct test* test_dedup_stopped();
+
+
+// Main test function.
+
+struct unit* unit_config_35() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 35 Options");
+
+    ADD_TEST(unit, test_dedup_run());
+    ADD_TEST(unit, test_dedup_window());
+    ADD_TEST(unit, test_dedup_stopped());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static int log_file_line_of(const char* text) {
+
+    char line[1024];
+    int number = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp)) {
+        number++;
+
+        if (strstr(line, text)) {
+            fclose(fp);
+            return number;
+        }
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+static struct test* test_dedup_run() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+
+    // Repeats are counted and summed up before the next different log.
+    for (i = 0;  i < 5;  i++)
+        FLOGFLN_WARNING("DUP WARNING LOG");
+
+    ASSERT(log_file_lines("DUP WARNING LOG") == 1 && "Repeats written.");
+
+    for (i = 0;  i < 3;  i++)
+        FLOGFLN_ERROR("DUP ERROR LOG %d", i);
+
+    ASSERT(log_file_lines("DUP ERROR LOG") == 3 && "Logs not written.");
+    ASSERT(
+        log_file_line_of("last message repeated 4 times") == 2
+        && "Wrong summary."
+    );
+
+    // The same message from another call site is not a repeat.
+    FLOGFLN_ERROR("DUP ERROR LOG 2");
+    ASSERT(log_file_lines("DUP ERROR LOG 2") == 2 && "Log not written.");
+    ASSERT(log_file_lines("last message repeated") == 1 && "Wrong summary.");
+
+    PASS_TEST();
+}
+
+static struct test* test_dedup_window() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int i;
+
+    unlink(CLOG_FILE);
+
+    // A repeat after the window writes the summary of the run.
+    for (i = 0;  i < 4;  i++) {
+        if (i == 3)
+            usleep(300000);
+
+        FLOGFLN_WARNING("WINDOW WARNING LOG");
+    }
+
+    ASSERT(log_file_lines("WINDOW WARNING LOG") == 1 && "Repeats written.");
+    ASSERT(
+        log_file_lines("last message repeated 3 times") == 1
+        && "Summary not written."
+    );
+
+    PASS_TEST();
+}
+
+static void* dedup_thread(void* arg) {
+
+    (void) arg;
+
+    for (int i = 0;  i < 5;  i++)
+        FLOGFLN_WARNING("THREAD WARNING LOG");
+
+    return NULL;
+}
+
+static struct test* test_dedup_stopped() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    pthread_t thread;
+    int i;
+
+    unlink(CLOG_FILE);
+
+    // A run that stops is summed up by the next log of the thread once the
+    // run is older than the window, whatever its output.
+    for (i = 0;  i < 3;  i++)
+        FLOGFLN_WARNING("STOPPED WARNING LOG");
+
+    usleep(300000);
+    CLOGLN_INFO("STOPPED CONSOLE LOG");
+    ASSERT(
+        log_file_lines("last message repeated 2 times") == 1
+        && "Summary not written."
+    );
+
+    // The run of a thread is summed up when the thread exits.
+    pthread_create(&thread, NULL, dedup_thread, NULL);
+    pthread_join(thread, NULL);
+    ASSERT(log_file_lines("THREAD WARNING LOG") == 1 && "Repeats written.");
+    ASSERT(
+        log_file_lines("last message repeated 4 times") == 1
+        && "Summary not written at thread exit."
+    );
+
+    PASS_TEST();
+}
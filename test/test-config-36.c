@@ -0,0 +1,120 @@
+#include <unistd.h>
+#include "test-config-36.h"
+
+
+// Function Declarations
+
+static struct test* test_shed_levels();
+static struct test* test_shed_step_down();
+
+
+// Main test function.
+
+struct unit* unit_config_36() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 36 Options");
+
+    ADD_TEST(unit, test_shed_levels());
+    ADD_TEST(unit, test_shed_step_down());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static int count_args(int* count) {
+
+    return ++*count;
+}
+
+static struct test* test_shed_levels() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int traces = 0;
+    int i;
+
+    unlink(CLOG_FILE);
+
+    // Trace logs are shed while the ring fills up, warnings are not.
+    for (i = 0;  i < 4096;  i++) {
+        FLOGFLN_WARNING("SHED WARNING LOG");
+        FLOGFLN_TRACE("SHED TRACE LOG %d", count_args(&traces));
+    }
+
+    FLOG_FLUSH();
+
+    ASSERT(traces < 4096 && "No trace log shed.");
+    ASSERT(log_file_lines("SHED TRACE LOG") == traces && "Trace logs lost.");
+
+    // The writer steps back down once the ring is drained.
+    FLOGFLN_WARNING("DRAINED WARNING LOG");
+    FLOGFLN_TRACE("DRAINED TRACE LOG");
+    FLOG_FLUSH();
+
+    ASSERT(
+        log_file_lines("DRAINED TRACE LOG") == 1 && "Trace log still shed."
+    );
+
+    PASS_TEST();
+}
+
+static struct test* test_shed_step_down() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    struct _clog_async* a = &_clog_async;
+    int traces = 0;
+    int shed;
+
+    FLOG_CLOSE();
+    unlink(CLOG_FILE);
+
+    // Keep the writer thread from stepping down while the step is forced.
+    pthread_mutex_lock(&a->lock);
+    _clog_async_shed(a, a->mask + 1);
+    shed = !FLOG_ENABLED(TRACE) && FLOG_ENABLED(WARNING);
+    _clog_async_shed(a, 0);
+    pthread_mutex_unlock(&a->lock);
+
+    ASSERT(shed && "Wrong levels shed at the top step.");
+
+    // Trace logs are logged again as soon as the step is back down.
+    FLOGFLN_TRACE("STEPPED DOWN TRACE LOG %d", count_args(&traces));
+    FLOG_FLUSH();
+
+    ASSERT(traces == 1 && "Trace log still shed.");
+    ASSERT(
+        log_file_lines("STEPPED DOWN TRACE LOG") == 1 && "Trace log not written."
+    );
+
+    PASS_TEST();
+}
@@ -0,0 +1,109 @@
+#include <unistd.h>
+#include "test-config-37.h"
+
+
+// Function Declarations
+
+static struct test* test_enabled_static();
+static struct test* test_enabled_runtime();
+
+
+// Main test function.
+
+struct unit* unit_config_37() {
+
+    struct unit* unit = (struct unit*) malloc(sizeof(*unit));
+
+    unit->name = (char*) __FUNCTION__;
+    unit->result = true;
+    unit->tests = NULL;
+    unit->next = NULL;
+    assert(unit);
+    UNIT_HEADER("Testing Config 37 Options");
+
+    ADD_TEST(unit, test_enabled_static());
+    ADD_TEST(unit, test_enabled_runtime());
+
+    REVERSE_LIST(unit->tests);
+    PRINT_UNIT_RESULT(unit);
+    puts("");
+
+    return unit;
+}
+
+
+static int log_file_lines(const char* text) {
+
+    char line[1024];
+    int count = 0;
+    FILE* fp;
+
+    fp = fopen(CLOG_FILE, "r");
+
+    if (!fp)
+        return 0;
+
+    while (fgets(line, sizeof(line), fp))
+        count += strstr(line, text) != NULL;
+
+    fclose(fp);
+    return count;
+}
+
+static struct test* test_enabled_static() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int prepared = 0;
+
+    // Levels compiled out by CLOG_LEVEL and console logs disabled by
+    // CLOG_MODE are never enabled.
+    ASSERT(!LOG_ENABLED(DEBUG) && "DEBUG enabled.");
+    ASSERT(!FLOG_ENABLED(TRACE) && "TRACE enabled.");
+    ASSERT(!CLOG_ENABLED(ERROR) && "Console enabled.");
+    ASSERT(LOG_ENABLED(INFO) && "INFO disabled.");
+    ASSERT(FLOG_ENABLED(FATAL) && "FATAL disabled.");
+
+    LOG_IF_ENABLED(DEBUG) {
+        prepared++;
+    }
+
+    CLOG_IF_ENABLED(WARNING) {
+        prepared++;
+    }
+
+    ASSERT(!prepared && "Disabled guard ran.");
+
+    PASS_TEST();
+}
+
+static struct test* test_enabled_runtime() {
+
+    TEST_HEADER(__FUNCTION__);
+
+    int prepared = 0;
+
+    unlink(CLOG_FILE);
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_WARNING);
+    ASSERT(!LOG_ENABLED(INFO) && "INFO enabled at runtime.");
+
+    LOG_IF_ENABLED(INFO) {
+        prepared++;
+        LOGFLN_INFO("GUARDED INFO LOG");
+    }
+
+    FLOG_IF_ENABLED(ERROR) {
+        prepared++;
+        FLOGFLN_ERROR("GUARDED ERROR LOG");
+    }
+
+    CLOG_SET_LEVEL(CLOG_LEVEL_ALL);
+
+    ASSERT(prepared == 1 && "Wrong guards ran.");
+    ASSERT(log_file_lines("GUARDED INFO LOG") == 0 && "INFO logged.");
+    ASSERT(log_file_lines("GUARDED ERROR LOG") == 1 && "ERROR not logged.");
+    ASSERT(LOG_ENABLED(INFO) && "INFO not enabled again.");
+
+    PASS_TEST();
+}
@@ -5,6 +5,8 @@
 // Function Declarations
 
 static struct test* test_manual_fprint();
+static struct test* test_manual_fprint_hex_large();
+static struct test* test_manual_fprint_hexdump();
 
 
 // Main test function.
@@ -21,6 +23,8 @@ struct unit* unit_fprint() {
     UNIT_HEADER("Testing \"fprint\" Functions");
 
     ADD_TEST(unit, test_manual_fprint());
+    ADD_TEST(unit, test_manual_fprint_hex_large());
+    ADD_TEST(unit, test_manual_fprint_hexdump());
 
     REVERSE_LIST(unit->tests);
     PRINT_UNIT_RESULT(unit);
@@ -65,3 +69,102 @@ static struct test* test_manual_fprint() {
 }
 
 
+
+
+static struct test* test_manual_fprint_hex_large() {
+
+    // Odd size so the hex string spans several write blocks and vector
+    // steps and ends with a partial step.
+    static unsigned char data[4099];
+    static char expected[sizeof(data) * 5 + 1];
+    static char buf[sizeof(data) * 5 + 1];
+    FILE* stream;
+    size_t i, len;
+
+    TEST_HEADER(__FUNCTION__);
+
+    for (i = 0;  i < sizeof(data);  ++i)
+        data[i] = (unsigned char) (i * 7 + (i >> 8));
+
+    for (i = 0;  i < sizeof(data);  ++i)
+        sprintf(expected + i * 2, "%02x", data[i]);
+
+    stream = tmpfile();
+    ASSERT(stream);
+    FPRINT_HEX(stream, data, sizeof(data));
+    rewind(stream);
+    len = fread(buf, 1, sizeof(buf) - 1, stream);
+    fclose(stream);
+    printf("FPRINT_HEX: %zu characters\n", len);
+    ASSERT(len == sizeof(data) * 2 && "Hex string length wrong.");
+    ASSERT(!memcmp(buf, expected, len) && "Hex string wrong.");
+
+    for (i = 0;  i < sizeof(data);  ++i)
+        sprintf(expected + i * 5, "0x%02x ", data[i]);
+
+    stream = tmpfile();
+    ASSERT(stream);
+    FPRINT_WIDE_HEX(stream, data, sizeof(data));
+    rewind(stream);
+    len = fread(buf, 1, sizeof(buf) - 1, stream);
+    fclose(stream);
+    printf("FPRINT_WIDE_HEX: %zu characters\n", len);
+    ASSERT(len == sizeof(data) * 5 && "Wide hex string length wrong.");
+    ASSERT(!memcmp(buf, expected, len) && "Wide hex string wrong.");
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+
+
+static struct test* test_manual_fprint_hexdump() {
+
+    // Spans several write chunks and ends with a partial row.
+    static unsigned char data[2085];
+    static char expected[(sizeof(data) / 16 + 1) * 80 + 1];
+    static char buf[sizeof(expected)];
+    FILE* stream;
+    size_t i, j, len = 0;
+
+    TEST_HEADER(__FUNCTION__);
+
+    for (i = 0;  i < sizeof(data);  ++i)
+        data[i] = (unsigned char) (i * 7 + (i >> 8));
+
+    for (i = 0;  i < sizeof(data);  i += 16) {
+        len += sprintf(expected + len, "%08zx  ", i);
+
+        for (j = 0;  j < 16;  ++j) {
+            if (j == 8)
+                expected[len++] = ' ';
+
+            if (i + j < sizeof(data))
+                len += sprintf(expected + len, "%02x ", data[i + j]);
+            else
+                len += sprintf(expected + len, "   ");
+        }
+
+        len += sprintf(expected + len, " |");
+
+        for (j = 0;  j < 16 && i + j < sizeof(data);  ++j)
+            expected[len++] = isprint(data[i + j]) ? data[i + j] : '.';
+
+        len += sprintf(expected + len, "|\n");
+    }
+
+    stream = tmpfile();
+    ASSERT(stream);
+    FPRINT_HEXDUMP(stream, data, sizeof(data));
+    rewind(stream);
+    i = fread(buf, 1, sizeof(buf) - 1, stream);
+    fclose(stream);
+    printf("FPRINT_HEXDUMP: %zu characters\n", i);
+    fwrite(expected, 1, 79, stdout);
+    ASSERT(i == len && "Hex dump length wrong.");
+    ASSERT(!memcmp(buf, expected, len) && "Hex dump wrong.");
+    puts("\n");
+
+    PASS_TEST();
+}
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 #include "test.h"
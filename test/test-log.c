@@ -10,6 +10,8 @@ static struct test* test_manual_tlog();
 static struct test* test_manual_c_log();
 static struct test* test_manual_c_log_stream();
 static struct test* test_manual_c_tlog();
+static struct test* test_manual_log_dual_sink();
+static struct test* test_manual_log_time_cache();
 static struct test* test_manual_log_level();
 
 
@@ -32,6 +34,8 @@ struct unit* unit_log() {
     ADD_TEST(unit, test_manual_c_log());
     ADD_TEST(unit, test_manual_c_log_stream());
     ADD_TEST(unit, test_manual_c_tlog());
+    ADD_TEST(unit, test_manual_log_dual_sink());
+    ADD_TEST(unit, test_manual_log_time_cache());
     ADD_TEST(unit, test_manual_log_level());
 
     REVERSE_LIST(unit->tests);
@@ -468,6 +472,82 @@ static struct test* test_manual_c_tlog() {
 }
 
 
+static int next_count(int* count) {
+
+    return ++*count;
+}
+
+static struct test* test_manual_log_dual_sink() {
+
+    int count = 0, fd = 0;
+    char buf[LINE_BUF_SIZE];
+    char file_buf[LINE_BUF_SIZE];
+    char* time_end;
+
+    TEST_HEADER(__FUNCTION__);
+
+    fd = open(LOG_FILENAME, O_RDONLY);
+    ASSERT(fd);
+    lseek(fd, 0, SEEK_END);
+
+    // Arguments are evaluated once for both console and file.
+    FILL_LINE_BUF_FROM_STDERR(
+        buf, LINE_BUF_SIZE, C_TLOGFLN(C_RED, "COUNT %d", next_count(&count));
+    );
+    printf("STDERR: %s", buf);
+    PRINT_FILE_LINE(fd, file_buf);
+    ASSERT(count == 1 && "Arguments evaluated more than once.");
+    ASSERT(strstr(buf, C_RED "COUNT 1" C_RESET "\n") && "Console log wrong.");
+    ASSERT(strstr(file_buf, " COUNT 1\n") && "File log wrong.");
+    ASSERT(!strstr(file_buf, C_RED) && "RED found in log.");
+
+    // Both logs get the same timestamp.
+    time_end = strchr(buf, ' ');
+    ASSERT(time_end && "Time stamp not found.");
+    ASSERT(
+        !strncmp(buf, file_buf, time_end - buf)
+        && "Console and file time stamps differ."
+    );
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
+static struct test* test_manual_log_time_cache() {
+
+    int i = 0;
+    time_t before, after;
+    struct tm tm;
+    char buf[LINE_BUF_SIZE];
+    char expected[LINE_BUF_SIZE];
+
+    TEST_HEADER(__FUNCTION__);
+
+    // Cached time stamps match a freshly formatted local time.
+    for (i = 0; i < 8; i++) {
+        do {
+            before = time(NULL);
+            FILL_LINE_BUF_FROM_STDERR(
+                buf, LINE_BUF_SIZE, LOGFLN_INFO("TIME %d", i);
+            );
+            after = time(NULL);
+        } while (before != after);
+
+        localtime_r(&before, &tm);
+        strftime(expected, LINE_BUF_SIZE, CLOG_TIME_FORMAT " ", &tm);
+        printf("STDERR: %s", buf);
+        ASSERT(
+            !strncmp(buf, expected, strlen(expected))
+            && "Cached time stamp differs from local time."
+        );
+    }
+    puts("\n");
+
+    PASS_TEST();
+}
+
+
 static struct test* test_manual_log_level() {
 
     int integer = 1234567890, fd = 0;
@@ -27,6 +27,26 @@
 #include "test-config-15.h"
 #include "test-config-16.h"
 #include "test-config-17.h"
+#include "test-config-18.h"
+#include "test-config-19.h"
+#include "test-config-20.h"
+#include "test-config-21.h"
+#include "test-config-22.h"
+#include "test-config-23.h"
+#include "test-config-24.h"
+#include "test-config-25.h"
+#include "test-config-26.h"
+#include "test-config-27.h"
+#include "test-config-28.h"
+#include "test-config-29.h"
+#include "test-config-30.h"
+#include "test-config-31.h"
+#include "test-config-32.h"
+#include "test-config-33.h"
+#include "test-config-34.h"
+#include "test-config-35.h"
+#include "test-config-36.h"
+#include "test-config-37.h"
 
 
 /**
@@ -71,6 +91,26 @@ int main() {
     ADD_UNIT(units, unit_config_15());
     ADD_UNIT(units, unit_config_16());
     ADD_UNIT(units, unit_config_17());
+    ADD_UNIT(units, unit_config_18());
+    ADD_UNIT(units, unit_config_19());
+    ADD_UNIT(units, unit_config_20());
+    ADD_UNIT(units, unit_config_21());
+    ADD_UNIT(units, unit_config_22());
+    ADD_UNIT(units, unit_config_23());
+    ADD_UNIT(units, unit_config_24());
+    ADD_UNIT(units, unit_config_25());
+    ADD_UNIT(units, unit_config_26());
+    ADD_UNIT(units, unit_config_27());
+    ADD_UNIT(units, unit_config_28());
+    ADD_UNIT(units, unit_config_29());
+    ADD_UNIT(units, unit_config_30());
+    ADD_UNIT(units, unit_config_31());
+    ADD_UNIT(units, unit_config_32());
+    ADD_UNIT(units, unit_config_33());
+    ADD_UNIT(units, unit_config_34());
+    ADD_UNIT(units, unit_config_35());
+    ADD_UNIT(units, unit_config_36());
+    ADD_UNIT(units, unit_config_37());
 
     // Print summary. Don't need to free everything as exit is next.
     DID_UNITS_PASS(units, ret);